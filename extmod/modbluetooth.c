@@ -1276,6 +1276,9 @@ STATIC mp_obj_t invoke_irq_handler(uint16_t event,
         mp_stack_set_top(&ts + 1); // need to include ts in root-pointer scan
         mp_stack_set_limit(MICROPY_PY_BLUETOOTH_SYNC_EVENT_STACK_SIZE - 1024);
         ts.gc_lock_depth = 0;
+        #if MICROPY_GC_GENERATIONAL
+        ts.gc_minor_requested = false;
+        #endif
         ts.nlr_jump_callback_top = NULL;
         ts.mp_pending_exception = MP_OBJ_NULL;
         mp_locals_set(mp_state_ctx.thread.dict_locals); // set from the outer context
@@ -1710,6 +1713,7 @@ void mp_bluetooth_gatts_db_create_entry(mp_gatts_db_t db, uint16_t handle, size_
     entry->data_len = 0;
     entry->append = false;
     elem->value = MP_OBJ_FROM_PTR(entry);
+    gc_write_barrier(db->table);
 }
 
 mp_bluetooth_gatts_db_entry_t *mp_bluetooth_gatts_db_lookup(mp_gatts_db_t db, uint16_t handle) {
@@ -28,6 +28,7 @@
 #include "py/mpconfig.h"
 #include "py/runtime.h"
 #include "py/obj.h"
+#include "py/gc.h"
 #include "py/objlist.h"
 #include "py/stream.h"
 #include "py/mperrno.h"
@@ -240,6 +241,7 @@ STATIC void poll_set_add_obj(poll_set_t *poll_set, const mp_obj_t *obj, mp_uint_
             poll_obj_set_events(poll_obj, events);
             poll_obj_set_revents(poll_obj, 0);
             elem->value = MP_OBJ_FROM_PTR(poll_obj);
+            gc_write_barrier(poll_set->map.table);
         } else {
             // object exists; update its events
             poll_obj_t *poll_obj = (poll_obj_t *)MP_OBJ_TO_PTR(elem->value);
@@ -36,6 +36,7 @@
 #include "esp_wifi.h"
 #include "esp_wifi_types.h"
 
+#include "py/gc.h"
 #include "py/runtime.h"
 #include "py/mphal.h"
 #include "py/mperrno.h"
@@ -332,6 +333,7 @@ static mp_map_elem_t *_lookup_add_peer(esp_espnow_obj_t *self, const uint8_t *pe
         mp_obj_t new_peer = mp_obj_new_bytes(peer, ESP_NOW_ETH_ALEN);
         item = mp_map_lookup(map, new_peer, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND);
         item->value = mp_obj_new_list(2, NULL);
+        gc_write_barrier(map->table);
         map->is_fixed = 1;      // Relock the dict
     }
     return item;
@@ -29,9 +29,11 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/mman.h>
+#include <unistd.h>
 
 #include "py/mpstate.h"
 #include "py/gc.h"
+#include "py/emitglue.h"
 
 #if MICROPY_EMIT_NATIVE || (MICROPY_PY_FFI && MICROPY_FORCE_PLAT_ALLOC_EXEC)
 
@@ -107,3 +109,90 @@ void ffi_closure_free(void *ptr) {
 MP_REGISTER_ROOT_POINTER(void *mmap_region_head);
 
 #endif // MICROPY_EMIT_NATIVE || (MICROPY_PY_FFI && MICROPY_FORCE_PLAT_ALLOC_EXEC)
+
+#if MICROPY_EMIT_MACHINE_CODE && MICROPY_PERF_MAP
+
+// Path of the perf map file, or NULL to use /tmp/perf-<pid>.map which is
+// where perf looks for symbols of code in anonymous executable memory.
+const char *mp_unix_perf_map_path = NULL;
+
+void mp_unix_perf_map_add(const void *ptr, size_t len, const char *name) {
+    static FILE *perf_map = NULL;
+    if (perf_map == NULL) {
+        const char *path = mp_unix_perf_map_path;
+        char default_path[32];
+        if (path == NULL) {
+            snprintf(default_path, sizeof(default_path), "/tmp/perf-%d.map", (int)getpid());
+            path = default_path;
+        }
+        perf_map = fopen(path, "w");
+        if (perf_map == NULL) {
+            // stop trying to write the map if the file can't be created
+            mp_perf_map_flag = false;
+            return;
+        }
+    }
+    // entries are "START SIZE NAME", with START and SIZE in hex
+    fprintf(perf_map, "%lx %lx %s\n", (unsigned long)(uintptr_t)ptr, (unsigned long)len, name);
+    fflush(perf_map);
+}
+
+#endif // MICROPY_EMIT_MACHINE_CODE && MICROPY_PERF_MAP
+
+#if MICROPY_GC_SPLIT_HEAP_AUTO
+
+#if defined(__OpenBSD__) || defined(__MACH__)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+// Heap areas added by the GC at runtime are mmap'd directly, rather than taken
+// from malloc, so that they are given back to the OS as soon as the GC finds
+// them empty and frees them.  The length of each mapping is stored just before
+// the memory handed to the GC, so that it can be passed to munmap.
+
+#define HEAP_REGION_HEADER (sizeof(size_t) * 2)
+
+size_t mp_unix_heap_add_limit;
+STATIC size_t heap_added;
+
+void *mp_unix_alloc_heap(size_t size) {
+    // size needs to be a multiple of the page size
+    size_t len = (size + HEAP_REGION_HEADER + 0xfff) & (~0xfff);
+    void *ptr = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) {
+        return NULL;
+    }
+    *(size_t *)ptr = len;
+    __atomic_add_fetch(&heap_added, len, __ATOMIC_RELAXED);
+    return (byte *)ptr + HEAP_REGION_HEADER;
+}
+
+void mp_unix_free_heap(void *ptr) {
+    ptr = (byte *)ptr - HEAP_REGION_HEADER;
+    size_t len = *(size_t *)ptr;
+    __atomic_sub_fetch(&heap_added, len, __ATOMIC_RELAXED);
+    munmap(ptr, len);
+}
+
+// Free memory inside an area that is still in use, including the first area,
+// is given back by discarding the whole pages that it covers.  They read as
+// zero if they are touched again, and the GC clears memory that it allocates.
+void mp_unix_release_heap(void *ptr, size_t len) {
+    uintptr_t start = ((uintptr_t)ptr + 0xfff) & (~0xfff);
+    uintptr_t end = ((uintptr_t)ptr + len) & (~0xfff);
+    if (start < end) {
+        madvise((void *)start, end - start, MADV_DONTNEED);
+    }
+}
+
+// The largest new area is whatever is left of the limit set from -X heapmax,
+// less one page for the header and rounding of the mapping.
+size_t gc_get_max_new_split(void) {
+    size_t added = __atomic_load_n(&heap_added, __ATOMIC_RELAXED);
+    if (added + 0x2000 > mp_unix_heap_add_limit) {
+        return 0;
+    }
+    return ((mp_unix_heap_add_limit - added) & (~0xfff)) - 0x1000;
+}
+
+#endif // MICROPY_GC_SPLIT_HEAP_AUTO
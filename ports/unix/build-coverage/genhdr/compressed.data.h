@@ -0,0 +1,246 @@
+#define MP_MAX_UNCOMPRESSED_TEXT_LEN (73)
+MP_COMPRESSED_DATA("can'\364'%q\247argument\363argumen\364objec\364functio\356forma\364'%s\247mus\364no\364positiona\354t\357conver\364keywor\344strin\347specifie\362b\345typ\345unsupporte\344o\346require\344fo\362inde\370ar\347attribut\345doesn'\364invali\344wit\350%\344i\356\341empt\371implemente\344isn'\364require\363assignmen\364identifie\362outsid\345a\356expectin\347generato\362supporte\344lengt\350expecte\344sequenc\345fro\355comple\370erro\362intege\362missin\347rang\345unknow\356conversio\356n\357synta\370bu\364ha\363in\364nam\345redefine\344afte\362fiel\344foun\344give\356multipl\345need\363nonloca\354overflo\367tupl\345allowe\344expect\363indice\363ou\364struct\272suppor\364to\357%\361dic\364i\363lis\364o\362zer\357impor\364numbe\362retur\356shoul\344specificatio\356value\363incompatibl\345issubclass(\251%\363an\344byte\363clas\363instructio\356labe\354loca\354stor\345take\363valu\345allocatio\356annotatio\356expressio\356implicitl\371incomplet\345parameter\363unexpecte\344.mp\371arg\363assemble\362automati\343cod\345hea\360integers\254numberin\347operatio\356sel\346a\364negativ\345addres\363defaul\364define\344failed\254go\364se\364'data\247befor\345binar\371")
+MP_MATCH_COMPRESSED("%c needs int or char", "\377%c\301\271\320char")
+MP_MATCH_COMPRESSED("%q index out of range", "\377\314\226\310\223\262")
+MP_MATCH_COMPRESSED("%q indices must be integers, not %s", "\377\314\307\210\220\361\211\332")
+MP_MATCH_COMPRESSED("%q() takes %d positional arguments but %d were given", "\377%q()\342\234\212\202\267\234were\277")
+MP_MATCH_COMPRESSED("'%q' argument required", "\377\201\203\224")
+MP_MATCH_COMPRESSED("'%s' doesn't support these operands", "\377\207\231\312these operands")
+MP_MATCH_COMPRESSED("'%s' expects a label", "\377\207\306\236\337")
+MP_MATCH_COMPRESSED("'%s' expects an address of the form [base, index, scale, disp]", "\377\207\306\246\367\223the form [base, index, scale, disp]")
+MP_MATCH_COMPRESSED("'%s' integer doesn't fit in 64 bits", "\377\207\260\231fit\23564 bits")
+MP_MATCH_COMPRESSED("'%s' object doesn't support item assignment", "\377\207\204\231\312item\243")
+MP_MATCH_COMPRESSED("'%s' object doesn't support item deletion", "\377\207\204\231\312item deletion")
+MP_MATCH_COMPRESSED("'%s' object has no attribute '%q'", "\377\207\204\270\265\230\201")
+MP_MATCH_COMPRESSED("'%s' object isn't an iterator", "\377\207\204\241\246iterator")
+MP_MATCH_COMPRESSED("'%s' object isn't callable", "\377\207\204\241callable")
+MP_MATCH_COMPRESSED("'%s' object isn't iterable", "\377\207\204\241iterable")
+MP_MATCH_COMPRESSED("'%s' object isn't subscriptable", "\377\207\204\241subscriptable")
+MP_MATCH_COMPRESSED("'=' alignment not allowed in string format specifier", "\377'=' alignment\211\305\235\216\206\217")
+MP_MATCH_COMPRESSED("'align' requires 1 argument", "\377'align'\2421\203")
+MP_MATCH_COMPRESSED("'await' outside function", "\377'await'\245\205")
+MP_MATCH_COMPRESSED("'break'/'continue' outside loop", "\377'break'/'continue'\245loop")
+MP_MATCH_COMPRESSED("'data' requires at least 2 arguments", "\377\375\242\365least 2\202")
+MP_MATCH_COMPRESSED("'data' requires integer arguments", "\377\375\242\260\202")
+MP_MATCH_COMPRESSED("'label' requires 1 argument", "\377'label'\2421\203")
+MP_MATCH_COMPRESSED("'return' outside function", "\377'return'\245\205")
+MP_MATCH_COMPRESSED("'yield' outside function", "\377'yield'\245\205")
+MP_MATCH_COMPRESSED("* arg after **", "\377*\227\274**")
+MP_MATCH_COMPRESSED("*x must be assignment target", "\377*x\210\220\243target")
+MP_MATCH_COMPRESSED("0.0 to a complex power", "\3770.0\213\236\256power")
+MP_MATCH_COMPRESSED("I/O operation on closed file", "\377I/O\363on closed file")
+MP_MATCH_COMPRESSED("LHS of keyword arg must be an id", "\377LHS\223\215\227\210\220\246id")
+MP_MATCH_COMPRESSED("[addrinfo error %d]", "\377[addrinfo\257%d]")
+MP_MATCH_COMPRESSED("__init__() should return None, not '%s'", "\377__init__()\325\324None,\211\207")
+MP_MATCH_COMPRESSED("abort() called", "abort() called")
+MP_MATCH_COMPRESSED("address %08x is not aligned to %d bytes", "\377\367%08x\316\211aligned\213\234\334")
+MP_MATCH_COMPRESSED("annotation must be an identifier", "\377\345\210\220\246\244")
+MP_MATCH_COMPRESSED("arg is an empty sequence", "\377\227\316\246\237\254")
+MP_MATCH_COMPRESSED("arg must be user-type", "\377\227\210\220user-type")
+MP_MATCH_COMPRESSED("argument name reused", "\377\203\272reused")
+MP_MATCH_COMPRESSED("argument num/types mismatch", "\377\203num/types mismatch")
+MP_MATCH_COMPRESSED("argument should be a '%q' not a '%q'", "\377\203\325\220\236\201\211\236\201")
+MP_MATCH_COMPRESSED("array/bytes required on right side", "\377array/bytes\224on right side")
+MP_MATCH_COMPRESSED("async for/with outside async function", "\377async for/with\245async\205")
+MP_MATCH_COMPRESSED("attributes not supported", "\377attributes\211\251")
+MP_MATCH_COMPRESSED("bad compile mode", "bad compile mode")
+MP_MATCH_COMPRESSED("bad typecode", "bad typecode")
+MP_MATCH_COMPRESSED("binary op %q not implemented", "\377\377op\314\211\240")
+MP_MATCH_COMPRESSED("bits must be 32 or less", "\377bits\210\22032\320less")
+MP_MATCH_COMPRESSED("buffer too small", "\377buffer\313small")
+MP_MATCH_COMPRESSED("bytecode overflow", "\377bytecode\303")
+MP_MATCH_COMPRESSED("bytes value out of range", "\377\334\343\310\223\262")
+MP_MATCH_COMPRESSED("can only have up to 4 parameters to x64 assembly", "\377can only have up\2134\351\213x64 assembly")
+MP_MATCH_COMPRESSED("can't add special method to already-subclassed class", "\377\200add special method\213already-subclassed\335")
+MP_MATCH_COMPRESSED("can't assign to expression", "\377\200assign\213\346")
+MP_MATCH_COMPRESSED("can't cancel self", "\377\200cancel\364")
+MP_MATCH_COMPRESSED("can't convert %s to complex", "\377\200\214\332\213\256")
+MP_MATCH_COMPRESSED("can't convert %s to float", "\377\200\214\332\213float")
+MP_MATCH_COMPRESSED("can't convert %s to int", "\377\200\214\332\213\271")
+MP_MATCH_COMPRESSED("can't convert '%q' object to %q implicitly", "\377\200\214\201\204\213\314\347")
+MP_MATCH_COMPRESSED("can't convert '%q' to '%q'", "\377\200\214\201\213\201")
+MP_MATCH_COMPRESSED("can't convert NaN to int", "\377\200\214NaN\213\271")
+MP_MATCH_COMPRESSED("can't convert inf to int", "\377\200\214inf\213\271")
+MP_MATCH_COMPRESSED("can't create '%q' instances", "\377\200create\201instances")
+MP_MATCH_COMPRESSED("can't declare nonlocal in outer code", "\377\200declare\302\235outer\357")
+MP_MATCH_COMPRESSED("can't delete expression", "\377\200delete\346")
+MP_MATCH_COMPRESSED("can't do binary op between '%q' and '%q'", "\377\200do\377op between\201\333\201")
+MP_MATCH_COMPRESSED("can't implicitly convert '%q' to 'bool'", "\377\200\347\214\201\213'bool'")
+MP_MATCH_COMPRESSED("can't import name %q", "\377\200\322\272\314")
+MP_MATCH_COMPRESSED("can't load from '%q'", "\377\200load\255\201")
+MP_MATCH_COMPRESSED("can't load with '%q' index", "\377\200load\233\201\226")
+MP_MATCH_COMPRESSED("can't perform relative import", "\377\200perform relative\322")
+MP_MATCH_COMPRESSED("can't send non-None value to a just-started generator", "\377\200send non-None\343\213\236just-started\250")
+MP_MATCH_COMPRESSED("can't set attribute", "\377\200\374\230")
+MP_MATCH_COMPRESSED("can't store '%q'", "\377\200\341\201")
+MP_MATCH_COMPRESSED("can't store to '%q'", "\377\200\341\213\201")
+MP_MATCH_COMPRESSED("can't store with '%q' index", "\377\200\341\233\201\226")
+MP_MATCH_COMPRESSED("can't switch from automatic field numbering to manual field specification", "\377\200switch\255\356\275\362\213manual\275\326")
+MP_MATCH_COMPRESSED("can't switch from manual field specification to automatic field numbering", "\377\200switch\255manual\275\326\213\356\275\362")
+MP_MATCH_COMPRESSED("can't truncate-divide a complex number", "\377\200truncate-divide\236\256\323")
+MP_MATCH_COMPRESSED("can't unambiguously get sizeof scalar", "\377\200unambiguously get sizeof scalar")
+MP_MATCH_COMPRESSED("can't wait", "\377\200wait")
+MP_MATCH_COMPRESSED("casting", "casting")
+MP_MATCH_COMPRESSED("chr() arg not in range(0x110000)", "\377chr()\227\211\235range(0x110000)")
+MP_MATCH_COMPRESSED("comparison of int and uint", "\377comparison\223\271\333uint")
+MP_MATCH_COMPRESSED("complex divide by zero", "\377\256divide by\321")
+MP_MATCH_COMPRESSED("conversion to object", "\377\264\213\204")
+MP_MATCH_COMPRESSED("default 'except' must be last", "\377\370'except'\210\220last")
+MP_MATCH_COMPRESSED("dict update sequence has wrong length", "\377\315update\254\270wrong\252")
+MP_MATCH_COMPRESSED("div/mod not implemented for uint", "\377div/mod\211\240\225uint")
+MP_MATCH_COMPRESSED("divide by zero", "\377divide by\321")
+MP_MATCH_COMPRESSED("empty", "\377\237")
+MP_MATCH_COMPRESSED("empty heap", "\377\237\360")
+MP_MATCH_COMPRESSED("empty separator", "\377\237separator")
+MP_MATCH_COMPRESSED("end of format while looking for conversion specifier", "\377end\223\206while looking\225\264\217")
+MP_MATCH_COMPRESSED("error in regex", "\377\257\235regex")
+MP_MATCH_COMPRESSED("exceptions must derive from BaseException", "\377exceptions\210derive\255BaseException")
+MP_MATCH_COMPRESSED("expected ':' after format specifier", "\377\253':'\274\206\217")
+MP_MATCH_COMPRESSED("expecting a dict for keyword args", "\377\247\236\315\225\215\354")
+MP_MATCH_COMPRESSED("expecting an assembler instruction", "\377\247\246\355\336")
+MP_MATCH_COMPRESSED("expecting just a value for set", "\377\247just\236\343\225\374")
+MP_MATCH_COMPRESSED("expecting key:value for dict", "\377\247key:value\225\315")
+MP_MATCH_COMPRESSED("extra keyword arguments given", "\377extra\215\202\277")
+MP_MATCH_COMPRESSED("extra positional arguments given", "\377extra\212\202\277")
+MP_MATCH_COMPRESSED("format", "\377\206")
+MP_MATCH_COMPRESSED("format needs a dict", "\377\206\301\236\315")
+MP_MATCH_COMPRESSED("format string didn't convert all arguments", "\377\206\216didn't\214all\202")
+MP_MATCH_COMPRESSED("format string needs more arguments", "\377\206\216\301more\202")
+MP_MATCH_COMPRESSED("full", "full")
+MP_MATCH_COMPRESSED("function doesn't take keyword arguments", "\377\205\231take\215\202")
+MP_MATCH_COMPRESSED("function expected at most %d arguments, got %d", "\377\205\253\365most\234arguments,\373\234")
+MP_MATCH_COMPRESSED("function got multiple values for argument '%q'", "\377\205\373\300\327\225\203\201")
+MP_MATCH_COMPRESSED("function missing %d required positional arguments", "\377\205\261\234\224\212\202")
+MP_MATCH_COMPRESSED("function missing keyword-only argument", "\377\205\261keyword-only\203")
+MP_MATCH_COMPRESSED("function missing required keyword argument '%q'", "\377\205\261\224\215\203\201")
+MP_MATCH_COMPRESSED("function missing required positional argument #%d", "\377\205\261\224\212\203#%d")
+MP_MATCH_COMPRESSED("function takes %d positional arguments but %d were given", "\377\205\342\234\212\202\267\234were\277")
+MP_MATCH_COMPRESSED("generator already executing", "\377\250already executing")
+MP_MATCH_COMPRESSED("generator ignored GeneratorExit", "\377\250ignored GeneratorExit")
+MP_MATCH_COMPRESSED("generator raised StopIteration", "\377\250raised StopIteration")
+MP_MATCH_COMPRESSED("hash is final", "\377hash\316final")
+MP_MATCH_COMPRESSED("heap must be a list", "\377\360\210\220\236\317")
+MP_MATCH_COMPRESSED("identifier redefined as global", "\377\244\273as global")
+MP_MATCH_COMPRESSED("identifier redefined as nonlocal", "\377\244\273as\302")
+MP_MATCH_COMPRESSED("import * not at module level", "\377\322*\211\365module level")
+MP_MATCH_COMPRESSED("incompatible .mpy arch", "\377\330\353arch")
+MP_MATCH_COMPRESSED("incompatible .mpy file", "\377\330\353file")
+MP_MATCH_COMPRESSED("incomplete format", "\377\350\206")
+MP_MATCH_COMPRESSED("incomplete format key", "\377\350\206key")
+MP_MATCH_COMPRESSED("incorrect padding", "incorrect padding")
+MP_MATCH_COMPRESSED("inline assembler must be a function", "\377inline\355\210\220\236\205")
+MP_MATCH_COMPRESSED("int() arg 2 must be >= 2 and <= 36", "\377int()\2272\210\220>= 2\333<= 36")
+MP_MATCH_COMPRESSED("integer needed", "\377\260needed")
+MP_MATCH_COMPRESSED("invalid format", "\377\232\206")
+MP_MATCH_COMPRESSED("invalid format specifier", "\377\232\206\217")
+MP_MATCH_COMPRESSED("invalid micropython decorator", "\377\232micropython decorator")
+MP_MATCH_COMPRESSED("invalid mktime usage", "\377\232mktime usage")
+MP_MATCH_COMPRESSED("invalid syntax", "\377\232\266")
+MP_MATCH_COMPRESSED("invalid syntax for number", "\377\232\266\225\323")
+MP_MATCH_COMPRESSED("issubclass() arg 1 must be a class", "\377\331\2271\210\220\236\335")
+MP_MATCH_COMPRESSED("issubclass() arg 2 must be a class or a tuple of classes", "\377\331\2272\210\220\236\335\320\236\304\223classes")
+MP_MATCH_COMPRESSED("join expects a list of str/bytes objects consistent with self object", "\377join\306\236\317\223str/bytes objects consistent\233\364\204")
+MP_MATCH_COMPRESSED("keyword argument(s) not implemented - use normal args instead", "\377\215argument(s)\211\240- use normal\354instead")
+MP_MATCH_COMPRESSED("label '%q' not defined", "\377\337\201\211\371")
+MP_MATCH_COMPRESSED("label redefined", "\377\337\273")
+MP_MATCH_COMPRESSED("lhs and rhs should be compatible", "\377lhs\333rhs\325\220compatible")
+MP_MATCH_COMPRESSED("local '%q' has type '%q' but source is '%q'", "\377\340\201\270\221\201\267source\316\201")
+MP_MATCH_COMPRESSED("local '%q' used before type known", "\377\340\201used\376\221known")
+MP_MATCH_COMPRESSED("local variable referenced before assignment", "\377\340variable referenced\376\243")
+MP_MATCH_COMPRESSED("malformed f-string", "malformed f-string")
+MP_MATCH_COMPRESSED("math domain error", "\377math domain\257")
+MP_MATCH_COMPRESSED("memory allocation failed, allocating %u bytes", "\377memory\344\372allocating %u\334")
+MP_MATCH_COMPRESSED("memory allocation failed, heap is locked", "\377memory\344\372\360\316locked")
+MP_MATCH_COMPRESSED("memoryview offset too large", "\377memoryview offset\313large")
+MP_MATCH_COMPRESSED("mktime needs a tuple of length 8 or 9", "\377mktime\301\236\304\223\2528\3209")
+MP_MATCH_COMPRESSED("multiple *x in assignment", "\377\300*x\235\243")
+MP_MATCH_COMPRESSED("multiple bases have instance lay-out conflict", "\377\300bases have instance lay-out conflict")
+MP_MATCH_COMPRESSED("must raise an object", "\377\210raise\246\204")
+MP_MATCH_COMPRESSED("must use keyword argument for key function", "\377\210use\215\203\225key\205")
+MP_MATCH_COMPRESSED("name '%q' isn't defined", "\377\272\201\241\371")
+MP_MATCH_COMPRESSED("name too long", "\377\272\313long")
+MP_MATCH_COMPRESSED("native code in .mpy unsupported", "\377native\357\235\353\222")
+MP_MATCH_COMPRESSED("native yield", "native yield")
+MP_MATCH_COMPRESSED("need more than %d values to unpack", "\377need more than\234\327\213unpack")
+MP_MATCH_COMPRESSED("negative factorial", "\377\366factorial")
+MP_MATCH_COMPRESSED("negative shift count", "\377\366shift count")
+MP_MATCH_COMPRESSED("no active exception to reraise", "\377\265active exception\213reraise")
+MP_MATCH_COMPRESSED("no binding for nonlocal found", "\377\265binding\225\302\276")
+MP_MATCH_COMPRESSED("no module named '%q'", "\377\265module named\201")
+MP_MATCH_COMPRESSED("no such attribute", "\377\265such\230")
+MP_MATCH_COMPRESSED("non-default argument follows default argument", "\377non-default\203follows\370\203")
+MP_MATCH_COMPRESSED("non-hex digit found", "\377non-hex digit\276")
+MP_MATCH_COMPRESSED("not a constant", "\377\211\236constant")
+MP_MATCH_COMPRESSED("object '%s' isn't a tuple or list", "\377\204\207\241\236\304\320\317")
+MP_MATCH_COMPRESSED("object not in sequence", "\377\204\211\235\254")
+MP_MATCH_COMPRESSED("object of type '%s' has no len()", "\377\204\223\221\207\270\265len()")
+MP_MATCH_COMPRESSED("object with buffer protocol required", "\377\204\233buffer protocol\224")
+MP_MATCH_COMPRESSED("odd-length string", "\377odd-length\216")
+MP_MATCH_COMPRESSED("only slices with step=1 (aka None) are supported", "\377only slices\233step=1 (aka None) are\251")
+MP_MATCH_COMPRESSED("opcode", "opcode")
+MP_MATCH_COMPRESSED("ord() expected a character, but string of length %d found", "\377ord()\253\236character,\267\216\223\252\234\276")
+MP_MATCH_COMPRESSED("overflow converting long int to machine word", "\377\303converting long\271\213machine word")
+MP_MATCH_COMPRESSED("parameters must be registers in sequence rdi, rsi, rdx, rcx", "\377\351\210\220registers\235\254rdi, rsi, rdx, rcx")
+MP_MATCH_COMPRESSED("pop from an empty set", "\377pop\255\246\237\374")
+MP_MATCH_COMPRESSED("pop from empty list", "\377pop\255\237\317")
+MP_MATCH_COMPRESSED("popitem(): dictionary is empty", "\377popitem(): dictionary\316\237")
+MP_MATCH_COMPRESSED("positional arg after **", "\377\212\227\274**")
+MP_MATCH_COMPRESSED("positional arg after keyword arg", "\377\212\227\274\215\227")
+MP_MATCH_COMPRESSED("pow() with 3 arguments requires integers", "\377pow()\2333\202\242integers")
+MP_MATCH_COMPRESSED("raw f-strings are not supported", "\377raw f-strings are\211\251")
+MP_MATCH_COMPRESSED("requested length %d but object has length %d", "\377requested\252\234\267\204\270\252\234")
+MP_MATCH_COMPRESSED("return annotation must be an identifier", "\377\324\345\210\220\246\244")
+MP_MATCH_COMPRESSED("return expected '%q' but got '%q'", "\377\324\253\201\267\373\201")
+MP_MATCH_COMPRESSED("rsplit(None,n)", "rsplit(None,n)")
+MP_MATCH_COMPRESSED("schedule queue full", "schedule queue full")
+MP_MATCH_COMPRESSED("sign not allowed in string format specifier", "\377sign\211\305\235\216\206\217")
+MP_MATCH_COMPRESSED("sign not allowed with integer format specifier 'c'", "\377sign\211\305\233\260\206\217'c'")
+MP_MATCH_COMPRESSED("single '}' encountered in format string", "\377single '}' encountered\235\206\216")
+MP_MATCH_COMPRESSED("slice step can't be zero", "\377slice step\200\220\321")
+MP_MATCH_COMPRESSED("splitting with sub-captures", "\377splitting\233sub-captures")
+MP_MATCH_COMPRESSED("start/end indices", "\377start/end\307")
+MP_MATCH_COMPRESSED("stream operation not supported", "\377stream\363\211\251")
+MP_MATCH_COMPRESSED("string argument without an encoding", "\377\216\203without\246encoding")
+MP_MATCH_COMPRESSED("string index out of range", "\377\216\226\310\223\262")
+MP_MATCH_COMPRESSED("string indices must be integers, not %s", "\377\216\307\210\220\361\211\332")
+MP_MATCH_COMPRESSED("struct: can't index", "\377\311\200\226")
+MP_MATCH_COMPRESSED("struct: index out of range", "\377\311\226\310\223\262")
+MP_MATCH_COMPRESSED("struct: no fields", "\377\311\265fields")
+MP_MATCH_COMPRESSED("substring not found", "\377substring\211\276")
+MP_MATCH_COMPRESSED("super() can't find self", "\377super()\200find\364")
+MP_MATCH_COMPRESSED("syntax error in JSON", "\377\266\257\235JSON")
+MP_MATCH_COMPRESSED("syntax error in uctypes descriptor", "\377\266\257\235uctypes descriptor")
+MP_MATCH_COMPRESSED("ticks interval overflow", "\377ticks interval\303")
+MP_MATCH_COMPRESSED("too many args", "\377\313many\354")
+MP_MATCH_COMPRESSED("too many values to unpack (expected %d)", "\377\313many\327\213unpack (expected %d)")
+MP_MATCH_COMPRESSED("tuple index out of range", "\377\304\226\310\223\262")
+MP_MATCH_COMPRESSED("type '%q' isn't an acceptable base type", "\377\221\201\241\246acceptable base\221")
+MP_MATCH_COMPRESSED("type object '%q' has no attribute '%q'", "\377\221\204\201\270\265\230\201")
+MP_MATCH_COMPRESSED("type takes 1 or 3 arguments", "\377\221\3421\3203\202")
+MP_MATCH_COMPRESSED("unary op %q not implemented", "\377unary op\314\211\240")
+MP_MATCH_COMPRESSED("unexpected indent", "\377\352indent")
+MP_MATCH_COMPRESSED("unexpected keyword argument '%q'", "\377\352\215\203\201")
+MP_MATCH_COMPRESSED("unicode name escapes", "\377unicode\272escapes")
+MP_MATCH_COMPRESSED("unindent doesn't match any outer indent level", "\377unindent\231match any outer indent level")
+MP_MATCH_COMPRESSED("unknown conversion specifier %c", "\377\263\264\217%c")
+MP_MATCH_COMPRESSED("unknown format code '%c' for object of type '%s'", "\377\263\206\357'%c'\225\204\223\221\207")
+MP_MATCH_COMPRESSED("unknown type", "\377\263\221")
+MP_MATCH_COMPRESSED("unknown type '%q'", "\377\263\221\201")
+MP_MATCH_COMPRESSED("unmatched '{' in format", "\377unmatched '{'\235\206")
+MP_MATCH_COMPRESSED("unreadable attribute", "\377unreadable\230")
+MP_MATCH_COMPRESSED("unsupported format character '%c' (0x%x) at index %d", "\377\222\206character '%c' (0x%x)\365\226\234")
+MP_MATCH_COMPRESSED("unsupported type for %q: '%s'", "\377\222\221\225%q:\207")
+MP_MATCH_COMPRESSED("unsupported types for %q: '%s', '%s'", "\377\222types\225%q: '%s',\207")
+MP_MATCH_COMPRESSED("unsupported x64 instruction '%s' with %d arguments", "\377\222x64\336\207\233\234\202")
+MP_MATCH_COMPRESSED("wbits", "wbits")
+MP_MATCH_COMPRESSED("wrong number of arguments", "\377wrong\323\223\202")
+MP_MATCH_COMPRESSED("zero step", "\377\321step")
+// Total input length:      7135
+// Total compressed length: 3358
+// Total data length:       1170
+// Predicted saving:        2607
+
+// gzip length:             3884
+// Percentage of gzip:      116.6%
+// zlib length:             3872
+// Percentage of zlib:      116.9%
@@ -0,0 +1,3 @@
+// This file was generated by py/makeversionhdr.py
+#define MICROPY_GIT_TAG "0f4d916-dirty"
+#define MICROPY_BUILD_DATE "2026-10-16"